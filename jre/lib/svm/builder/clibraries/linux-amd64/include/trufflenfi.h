@@ -222,6 +222,10 @@ struct __TruffleThreadAPI {
 
     /**
      * Detaches the current thread.
+     *
+     * Threads that repeatedly call back into the same context (e.g. pooled worker threads) do not
+     * need to detach after every callback. They can stay attached and detach once before the thread
+     * exits, see {@link getOrAttachCurrentThread}.
      */
     void (*detachCurrentThread)(TruffleContext *ctx);
 };
@@ -241,6 +245,19 @@ struct __TruffleContext {
     void detachCurrentThread() {
         return functions->detachCurrentThread(this);
     }
+
+    /**
+     * Convenience function that returns the TruffleEnv of the current thread, attaching the thread
+     * only if it is not attached yet. A thread attached this way stays attached until it calls
+     * {@link detachCurrentThread}.
+     */
+    TruffleEnv *getOrAttachCurrentThread() {
+        TruffleEnv *env = functions->getTruffleEnv(this);
+        if (!env) {
+            env = functions->attachCurrentThread(this);
+        }
+        return env;
+    }
 #endif
 };
 